@@ -9,6 +9,34 @@
 #define DT 0.001
 #define NU 0.01
 
+// Modo de sincronização entre passos de tempo:
+//   0 -> barreiras da equipe OpenMP (versão original)
+//   1 -> sincronização ponto a ponto apenas entre threads vizinhas
+// Compile com -DSYNC_VIZINHOS=1 para ativar o segundo modo.
+#ifndef SYNC_VIZINHOS
+#define SYNC_VIZINHOS 0
+#endif
+
+#define TAM_LINHA_CACHE 64
+
+#if SYNC_VIZINHOS
+// Contador do último passo concluído por cada thread. O preenchimento evita
+// que os contadores de threads diferentes compartilhem a mesma linha de cache.
+typedef struct {
+    int passo;
+    char pad[TAM_LINHA_CACHE - sizeof(int)];
+} ContadorPasso;
+
+// Espera (sem locks) até que a thread 'viz' tenha concluído o passo 'passo'.
+static inline void aguardar_vizinho(ContadorPasso *cont, int viz, int passo) {
+    int visto;
+    do {
+        #pragma omp atomic read
+        visto = cont[viz].passo;
+    } while (visto < passo);
+}
+#endif
+
 int main() {
     // Alocar memória (sem alterações)
     double **u = malloc(NX * sizeof(double*));
@@ -43,6 +71,85 @@ int main() {
     
     double start = omp_get_wtime();
     
+#if SYNC_VIZINHOS
+    // Cada thread precisa, no máximo, de uma linha por thread para ter ao menos
+    // uma linha própria e manter a vizinhança em anel bem definida.
+    int nthreads = omp_get_max_threads();
+    if (nthreads > NX-2) nthreads = NX-2;
+
+    ContadorPasso *cont = aligned_alloc(TAM_LINHA_CACHE, nthreads * sizeof(ContadorPasso));
+    for (int k = 0; k < nthreads; k++) cont[k].passo = -1;
+
+    // UMA ÚNICA REGIÃO PARALELA para todos os passos de tempo.
+    // As linhas internas são divididas estaticamente em blocos contíguos. No passo t
+    // a thread lê apenas as linhas de fronteira das vizinhas (e as linhas periódicas
+    // 0 e NX-1, que pertencem à primeira e à última thread, vizinhas no anel), então
+    // basta esperar que as duas vizinhas tenham concluído o passo t-1.
+    #pragma omp parallel num_threads(nthreads)
+    {
+        int id = omp_get_thread_num();
+        int p = omp_get_num_threads();
+        int esq = (id + p - 1) % p;
+        int dir = (id + 1) % p;
+        int ini = 1 + (int)((long)id * (NX-2) / p);
+        int fim = 1 + (int)((long)(id + 1) * (NX-2) / p);
+
+        // Cópias privadas dos ponteiros: a troca é feita localmente por cada thread.
+        double **uc = u, **vc = v, **unc = un, **vnc = vn;
+
+        for (int t = 0; t < NT; t++) {
+            // Esperar as vizinhas terminarem o passo anterior: garante que as linhas
+            // lidas já foram escritas e que as linhas sobrescritas já foram lidas.
+            aguardar_vizinho(cont, esq, t-1);
+            aguardar_vizinho(cont, dir, t-1);
+            #pragma omp flush
+
+            for (int i = ini; i < fim; i++) {
+                for (int j = 1; j < NY-1; j++) {
+                    unc[i][j] = uc[i][j] + DT*NU*(uc[i+1][j] + uc[i-1][j] + uc[i][j+1] + uc[i][j-1] - 4*uc[i][j]);
+                    vnc[i][j] = vc[i][j] + DT*NU*(vc[i+1][j] + vc[i-1][j] + vc[i][j+1] + vc[i][j-1] - 4*vc[i][j]);
+                }
+                // Condição de contorno periódica em j: depende apenas da própria linha.
+                unc[i][0] = unc[i][NY-2];
+                unc[i][NY-1] = unc[i][1];
+                vnc[i][0] = vnc[i][NY-2];
+                vnc[i][NY-1] = vnc[i][1];
+            }
+
+            // Condição de contorno periódica em i: feita pelas threads donas das linhas copiadas.
+            if (ini == 1) {
+                for (int j = 0; j < NY; j++) {
+                    unc[NX-1][j] = unc[1][j];
+                    vnc[NX-1][j] = vnc[1][j];
+                }
+            }
+            if (fim == NX-1) {
+                for (int j = 0; j < NY; j++) {
+                    unc[0][j] = unc[NX-2][j];
+                    vnc[0][j] = vnc[NX-2][j];
+                }
+            }
+
+            // Publicar a conclusão do passo t para as vizinhas.
+            #pragma omp flush
+            #pragma omp atomic write
+            cont[id].passo = t;
+
+            double **ut = uc, **vt = vc;
+            uc = unc; vc = vnc;
+            unc = ut; vnc = vt;
+        }
+    } // Fim da região paralela. Única barreira de toda a simulação.
+
+    free(cont);
+
+    // Refazer a troca de ponteiros no escopo compartilhado, conforme a paridade de NT.
+    if (NT % 2 != 0) {
+        double **ut = u, **vt = v;
+        u = un; v = vn;
+        un = ut; vn = vt;
+    }
+#else
     // Loop de tempo PRINCIPAL - continua serial
     for (int t = 0; t < NT; t++) {
         
@@ -88,6 +195,8 @@ int main() {
         un = ut; vn = vt;
     }
     
+#endif
+
     double end = omp_get_wtime();
     printf("%.6f\n", end - start);
 